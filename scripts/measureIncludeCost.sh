@@ -0,0 +1,57 @@
+#!/usr/bin/env bash
+#
+# @file measureIncludeCost.sh
+# @brief Measures the compile time of a translation unit that includes the color headers.
+#
+# Compares the old include cost (color.hpp pulled in <iostream>) with the I/O free color.hpp
+# and color.hpp + color/io.hpp. Also reports whether the object file carries a static initializer.
+#
+# usage: ./scripts/measureIncludeCost.sh [runs]   (compiler: $CXX, default c++)
+
+set -euo pipefail
+
+RUNS="${1:-10}"
+CXX="${CXX:-c++}"
+SCRIPT_DIR="$(cd "$(dirname "${BASH_SOURCE[0]}")" && pwd)"
+INCLUDE_DIR="${SCRIPT_DIR}/../src/color/include"
+WORK_DIR="$(mktemp -d)"
+trap 'rm -rf "${WORK_DIR}"' EXIT
+
+BODY='int main() {
+  const color::RGB<double> rgb(0.1, 0.2, 0.3);
+  return color::convertToHSV(rgb).h() > 0.5 ? 1 : 0;
+}'
+
+printf '#include <color/color.hpp>\n#include <iostream>\n%s\n' "${BODY}" >"${WORK_DIR}/baseline_iostream.cpp"
+printf '#include <color/color.hpp>\n%s\n' "${BODY}" >"${WORK_DIR}/core.cpp"
+printf '#include <color/color.hpp>\n#include <color/io.hpp>\n%s\n' "${BODY}" >"${WORK_DIR}/core_io.cpp"
+
+measure() {
+  local name="$1"
+  local source="${WORK_DIR}/${name}.cpp"
+  local object="${WORK_DIR}/${name}.o"
+  local start
+  local end
+  local total=0
+
+  for ((i = 0; i < RUNS; ++i)); do
+    start=$(date +%s%N)
+    "${CXX}" -std=c++20 -O0 -I"${INCLUDE_DIR}" -c "${source}" -o "${object}"
+    end=$(date +%s%N)
+    total=$((total + end - start))
+  done
+
+  local static_init="no"
+  local symbols
+  symbols="$(nm -C "${object}")"
+  if grep -q "_GLOBAL__sub_I\|ios_base::Init" <<<"${symbols}"; then
+    static_init="yes"
+  fi
+
+  printf '%-20s %8d ms   static initializer: %s\n' "${name}" $((total / RUNS / 1000000)) "${static_init}"
+}
+
+echo "compiler: $("${CXX}" --version | head -n 1), ${RUNS} runs, average per TU"
+measure baseline_iostream
+measure core
+measure core_io
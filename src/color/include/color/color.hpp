@@ -1,6 +1,8 @@
 /**
  * @file color.hpp
- * @brief contains template classes to define rgb or hsv color which can be converted into each other.
+ * @brief contains template classes to define rgb, linear rgb or hsv color which can be converted into each other.
+ *
+ * @detail This header is I/O free. Include <color/io.hpp> to stream colors.
  *
  * @date 30.03.2025
  * @author Jakob Wandel
@@ -13,7 +15,7 @@
 #include <array>
 #include <cassert>
 #include <cmath>
-#include <iostream>
+#include <string>
 #include <type_traits>
 #include <concepts>
 
@@ -120,15 +122,6 @@ class Color : public BaseColor<T, NUM_VALUES> {
   virtual std::string pigmentName(size_t) const = 0;
   virtual std::string getColorTypeName() const  = 0;
 
-  friend std::ostream& operator<<(std::ostream& os, const Color& c) {
-    os << c.getColorTypeName() << std::endl;
-    for (size_t i = 0; i < NUM_VALUES; ++i) {
-      os << "[" << c.pigmentName(i) << ": " << c.pigment[i] << "]";
-    }
-    os << std::endl;
-    return os;
-  }
-
   constexpr T& operator[](size_t x) { return this->pigment[x]; }
   constexpr T operator[](size_t x) const { return this->pigment[x]; }
 };
@@ -218,6 +211,88 @@ class RGB : public Color<T, NUM_VALUES> {
   }
 };
 
+/**
+ * @brief RGB in linear light, e.g. for blending or scaling. RGB holds the (gamma encoded) sRGB values.
+ *
+ * Convert with toLinear() and toSRGB().
+ */
+template <class T, size_t NUM_VALUES = 3>
+class LinearRGB : public Color<T, NUM_VALUES> {
+ public:
+  constexpr static bool has_alpha = (NUM_VALUES == 4);
+
+  constexpr LinearRGB() {}
+  constexpr LinearRGB(const LinearRGB& rgb)            = default;
+  constexpr LinearRGB(LinearRGB&& rgb)                 = default;
+  constexpr LinearRGB& operator=(const LinearRGB& rgb) = default;
+  constexpr LinearRGB& operator=(LinearRGB&& rgb)      = default;
+  ~LinearRGB()                                         = default;
+
+  template <class T_, size_t NUM_VALUES_>
+    requires color::NeedsConversation<T, T_, NUM_VALUES, NUM_VALUES_>
+  constexpr LinearRGB(const LinearRGB<T_, NUM_VALUES_>& rgb)
+      : Color<T, NUM_VALUES>(rgb.pigment) {}
+
+  template <class T_, size_t NUM_VALUES_>
+  constexpr LinearRGB(const std::array<T_, NUM_VALUES_>& pigments)
+      : Color<T, NUM_VALUES>(pigments) {}
+
+  template <class T_>
+  constexpr LinearRGB(T_ red, T_ green, T_ blue)
+      : Color<T, NUM_VALUES>(std::array<T_, 3>{{red, green, blue}}) {}
+
+  template <class T_>
+  constexpr LinearRGB(T_ red, T_ green, T_ blue, T_ alpha)
+      : Color<T, NUM_VALUES>(std::array<T_, 4>{{red, green, blue, alpha}}) {}
+
+  template <class T_, size_t NUM_VALUES_>
+    requires color::NeedsConversation<T, T_, NUM_VALUES, NUM_VALUES_>
+  constexpr LinearRGB<T, NUM_VALUES>& operator=(const LinearRGB<T_, NUM_VALUES_>& rgb) {
+    // constructor deals with different T
+    const LinearRGB<T, NUM_VALUES> temp(rgb);
+    constexpr size_t min = std::min(NUM_VALUES_, NUM_VALUES);
+    std::copy(&temp.pigment[0], &temp.pigment[0] + min, &this->pigment[0]);
+    return *this;
+  }
+
+  constexpr T r() const { return this->pigment[0]; }
+  constexpr T g() const { return this->pigment[1]; }
+  constexpr T b() const { return this->pigment[2]; }
+
+  constexpr T& r() { return this->pigment[0]; }
+  constexpr T& g() { return this->pigment[1]; }
+  constexpr T& b() { return this->pigment[2]; }
+
+  std::string pigmentName(size_t i) const override {
+    switch (i) {
+      case 0U:
+        return "R";
+      case 1U:
+        return "G";
+      case 2U:
+        return "B";
+      case 3U:
+        if (!has_alpha) {
+          assert((i == 0 || i == 1 || i == 2) &&
+                 "This color has no alpha value!");
+        }
+        return "A";
+      default:
+        assert((i == 0 || i == 1 || i == 2) &&
+               "pigmentName only supports i in [0, 1, 2]");
+        return "?";
+    }
+  }
+
+  std::string getColorTypeName() const override {
+    if constexpr (has_alpha) {
+      return "LinearRGBA";
+    } else {
+      return "LinearRGB";
+    }
+  }
+};
+
 template <class T, size_t NUM_VALUES = 3>
 class HSV : public Color<T, NUM_VALUES> {
  public:
@@ -332,7 +407,7 @@ constexpr RGB<double, NUM_VALUES> convertToRGB(const HSV<double, NUM_VALUES>& hs
 
 // h[0-1], s[0-1], v[0-1] -> r[0-1], g[0-1], b[0-1]
 template <size_t NUM_VALUES>
-static HSV<double, NUM_VALUES> convertToHSV(const RGB<double, NUM_VALUES>& rgb) {
+constexpr HSV<double, NUM_VALUES> convertToHSV(const RGB<double, NUM_VALUES>& rgb) {
   HSV<double, NUM_VALUES> hsv;
   // https://www.rapidtables.com/convert/color/rgb-to-hsv.html
 
@@ -370,4 +445,49 @@ static HSV<double, NUM_VALUES> convertToHSV(const RGB<double, NUM_VALUES>& rgb)
   return hsv;
 }
 
+// sRGB transfer function (IEC 61966-2-1): encoded c[0-1] -> linear light c[0-1]
+inline double srgbToLinear(double c) {
+  constexpr double THRESHOLD = 0.04045;
+  constexpr double SLOPE     = 12.92;
+  constexpr double OFFSET    = 0.055;
+  constexpr double GAMMA     = 2.4;
+  if (c <= THRESHOLD) {
+    return c / SLOPE;
+  }
+  return std::pow((c + OFFSET) / (1. + OFFSET), GAMMA);
+}
+
+// inverse sRGB transfer function: linear light c[0-1] -> encoded c[0-1]
+inline double linearToSRGB(double c) {
+  constexpr double THRESHOLD = 0.0031308;
+  constexpr double SLOPE     = 12.92;
+  constexpr double OFFSET    = 0.055;
+  constexpr double GAMMA     = 2.4;
+  if (c <= THRESHOLD) {
+    return c * SLOPE;
+  }
+  return (1. + OFFSET) * std::pow(c, 1. / GAMMA) - OFFSET;
+}
+
+// sRGB r[0-1], g[0-1], b[0-1] -> linear r[0-1], g[0-1], b[0-1], alpha is not gamma encoded
+template <size_t NUM_VALUES>
+LinearRGB<double, NUM_VALUES> toLinear(const RGB<double, NUM_VALUES>& rgb) {
+  LinearRGB<double, NUM_VALUES> linear(srgbToLinear(rgb.r()), srgbToLinear(rgb.g()), srgbToLinear(rgb.b()));
+  if constexpr (NUM_VALUES == 4) {
+    linear.a() = rgb.a();
+  }
+  return linear;
+}
+
+// linear r[0-1], g[0-1], b[0-1] -> sRGB r[0-1], g[0-1], b[0-1], alpha is not gamma encoded
+template <size_t NUM_VALUES>
+RGB<double, NUM_VALUES> toSRGB(const LinearRGB<double, NUM_VALUES>& linear) {
+  RGB<double, NUM_VALUES> rgb(
+    linearToSRGB(linear.r()), linearToSRGB(linear.g()), linearToSRGB(linear.b()));
+  if constexpr (NUM_VALUES == 4) {
+    rgb.a() = linear.a();
+  }
+  return rgb;
+}
+
 }  // namespace color
@@ -0,0 +1,266 @@
+/**
+ * @file distance.hpp
+ * @brief contains color distance metrics for single colors and batched kernels over two images.
+ *
+ * @detail All metrics work on normalized pigments [0 - 1], alpha is ignored.
+ *         The batched kernels only evaluate the sqrt free computeSquared(), reductions work on squared values.
+ *         CIE76/CIEDE2000 need a Lab color model which does not exist yet.
+ *
+ * @date 19.10.2026
+ * @author Jakob Wandel
+ * @version 1.0
+ **/
+
+#pragma once
+
+#include <color/color.hpp>
+#include <color/pixel_span.hpp>
+
+#include <algorithm>
+#include <array>
+#include <cassert>
+#include <cmath>
+#include <cstddef>
+#include <span>
+#include <type_traits>
+
+namespace color::distance {
+
+/**
+ * @brief Squared euclidean distance in RGB. Range [0 - 3].
+ *
+ * The metric is already squared, so computeSquared() is the distance and fromSquared()/toSquared() do nothing.
+ */
+struct EuclideanSquared {
+  template <template <class, size_t> class Model>
+  constexpr static bool supports = std::is_same_v<Model<float, 3>, RGB<float, 3>>;
+
+  template <class F>
+  static constexpr F computeSquared(const std::array<F, 3>& a, const std::array<F, 3>& b) {
+    const F dr = a[0] - b[0];
+    const F dg = a[1] - b[1];
+    const F db = a[2] - b[2];
+    return dr * dr + dg * dg + db * db;
+  }
+
+  template <class F>
+  static constexpr F fromSquared(F squared) {
+    return squared;
+  }
+
+  template <class F>
+  static constexpr F toSquared(F distance) {
+    return distance;
+  }
+
+  template <class F>
+  static constexpr F compute(const std::array<F, 3>& a, const std::array<F, 3>& b) {
+    return computeSquared(a, b);
+  }
+};
+
+/**
+ * @brief "redmean" weighted euclidean distance in RGB. Range [0 - 3].
+ *
+ * https://www.compuphase.com/cmetric.htm with the weights (2 + r/256) and (2 + (255 - r)/256)
+ * expressed for normalized pigments.
+ */
+struct Redmean {
+  template <template <class, size_t> class Model>
+  constexpr static bool supports = std::is_same_v<Model<float, 3>, RGB<float, 3>>;
+
+  template <class F>
+  static constexpr F computeSquared(const std::array<F, 3>& a, const std::array<F, 3>& b) {
+    constexpr F HALF = static_cast<F>(0.5);
+    const F redMean  = (a[0] + b[0]) * HALF;
+    const F dr       = a[0] - b[0];
+    const F dg       = a[1] - b[1];
+    const F db       = a[2] - b[2];
+    return (static_cast<F>(2.) + redMean) * dr * dr + static_cast<F>(4.) * dg * dg +
+           (static_cast<F>(3.) - redMean) * db * db;
+  }
+
+  template <class F>
+  static F fromSquared(F squared) {
+    return std::sqrt(squared);
+  }
+
+  template <class F>
+  static constexpr F toSquared(F distance) {
+    return distance * distance;
+  }
+
+  template <class F>
+  static F compute(const std::array<F, 3>& a, const std::array<F, 3>& b) {
+    return fromSquared(computeSquared(a, b));
+  }
+};
+
+/**
+ * @brief Euclidean distance in HSV where the hue difference is taken around the circle. Range [0 - sqrt(3)].
+ *
+ * The circular hue difference [0 - 0.5] is scaled to [0 - 1] so opposite hues are as far apart as
+ * black and white.
+ */
+struct HueAware {
+  template <template <class, size_t> class Model>
+  constexpr static bool supports = std::is_same_v<Model<float, 3>, HSV<float, 3>>;
+
+  template <class F>
+  static constexpr F computeSquared(const std::array<F, 3>& a, const std::array<F, 3>& b) {
+    const F dhLinear = std::abs(a[0] - b[0]);
+    const F dh       = static_cast<F>(2.) * std::min(dhLinear, static_cast<F>(1.) - dhLinear);
+    const F ds       = a[1] - b[1];
+    const F dv       = a[2] - b[2];
+    return dh * dh + ds * ds + dv * dv;
+  }
+
+  template <class F>
+  static F fromSquared(F squared) {
+    return std::sqrt(squared);
+  }
+
+  template <class F>
+  static constexpr F toSquared(F distance) {
+    return distance * distance;
+  }
+
+  template <class F>
+  static F compute(const std::array<F, 3>& a, const std::array<F, 3>& b) {
+    return fromSquared(computeSquared(a, b));
+  }
+};
+
+template <class Metric, template <class, size_t> class Model>
+concept MetricFor = Metric::template supports<Model>;
+
+template <class T, size_t NUM_VALUES>
+double euclideanSquared(const RGB<T, NUM_VALUES>& a, const RGB<T, NUM_VALUES>& b) {
+  const RGB<double, NUM_VALUES> ad(a);
+  const RGB<double, NUM_VALUES> bd(b);
+  return EuclideanSquared::compute<double>({{ad.r(), ad.g(), ad.b()}}, {{bd.r(), bd.g(), bd.b()}});
+}
+
+template <class T, size_t NUM_VALUES>
+double redmean(const RGB<T, NUM_VALUES>& a, const RGB<T, NUM_VALUES>& b) {
+  const RGB<double, NUM_VALUES> ad(a);
+  const RGB<double, NUM_VALUES> bd(b);
+  return Redmean::compute<double>({{ad.r(), ad.g(), ad.b()}}, {{bd.r(), bd.g(), bd.b()}});
+}
+
+template <class T, size_t NUM_VALUES>
+double hueAware(const HSV<T, NUM_VALUES>& a, const HSV<T, NUM_VALUES>& b) {
+  const HSV<double, NUM_VALUES> ad(a);
+  const HSV<double, NUM_VALUES> bd(b);
+  return HueAware::compute<double>({{ad.h(), ad.s(), ad.v()}}, {{bd.h(), bd.s(), bd.v()}});
+}
+
+namespace detail {
+// writes Metric::computeSquared, the sqrt free part of the metric
+template <class Metric, class T, size_t NUM_VALUES>
+void squaredDistanceKernel(std::span<const T> a, std::span<const T> b, std::span<float> squared) {
+  for (size_t i = 0; i < squared.size(); ++i) {
+    const size_t o = i * NUM_VALUES;
+    squared[i]     = Metric::computeSquared(std::array<float, 3>{{normalizedPigment<float>(a[o]),
+                                                                normalizedPigment<float>(a[o + 1]),
+                                                                normalizedPigment<float>(a[o + 2])}},
+                                          std::array<float, 3>{{normalizedPigment<float>(b[o]),
+                                                                normalizedPigment<float>(b[o + 1]),
+                                                                normalizedPigment<float>(b[o + 2])}});
+  }
+}
+
+// Calls reduce(std::span<const float>) for consecutive chunks of per pixel squared distances.
+template <class Metric, template <class, size_t> class Model, class T, size_t NUM_VALUES, class Reduce>
+void forEachChunk(const PixelSpan<Model, T, NUM_VALUES>& a,
+                  const PixelSpan<Model, T, NUM_VALUES>& b,
+                  Reduce&& reduce) {
+  assert(a.size() == b.size() && "Both images must have the same number of pixels");
+  constexpr size_t CHUNK_SIZE = color::detail::PIXEL_CHUNK_SIZE;
+  std::array<float, CHUNK_SIZE> buffer;
+  for (size_t first = 0; first < a.size(); first += CHUNK_SIZE) {
+    const size_t count = std::min(CHUNK_SIZE, a.size() - first);
+    const std::span<float> squared(buffer.data(), count);
+    squaredDistanceKernel<Metric, T, NUM_VALUES>(a.pigments.subspan(first * NUM_VALUES),
+                                                 b.pigments.subspan(first * NUM_VALUES),
+                                                 squared);
+    reduce(std::span<const float>(squared));
+  }
+}
+}  // namespace detail
+
+/**
+ * @brief Writes the per pixel distance of a and b into distances (size >= a.size()).
+ */
+template <class Metric, template <class, size_t> class Model, class T, size_t NUM_VALUES>
+  requires MetricFor<Metric, Model>
+void perPixelDistances(const PixelSpan<Model, T, NUM_VALUES>& a,
+                       const PixelSpan<Model, T, NUM_VALUES>& b,
+                       std::span<float> distances) {
+  assert(a.size() == b.size() && "Both images must have the same number of pixels");
+  assert(distances.size() >= a.size() && "Output must hold one distance per pixel");
+  const std::span<float> out = distances.first(a.size());
+  detail::squaredDistanceKernel<Metric, T, NUM_VALUES>(a.pigments, b.pigments, out);
+  for (float& d : out) {
+    d = Metric::fromSquared(d);
+  }
+}
+
+/**
+ * @brief Returns the largest per pixel distance of a and b, 0 for empty images.
+ */
+template <class Metric, template <class, size_t> class Model, class T, size_t NUM_VALUES>
+  requires MetricFor<Metric, Model>
+float maxDistance(const PixelSpan<Model, T, NUM_VALUES>& a, const PixelSpan<Model, T, NUM_VALUES>& b) {
+  // the metrics grow with their squared form, so one sqrt of the largest one is enough
+  float maximum = 0.f;
+  detail::forEachChunk<Metric>(a, b, [&maximum](std::span<const float> chunk) {
+    for (const float d : chunk) {
+      maximum = d > maximum ? d : maximum;
+    }
+  });
+  return Metric::fromSquared(maximum);
+}
+
+/**
+ * @brief Returns the mean per pixel distance of a and b, 0 for empty images.
+ */
+template <class Metric, template <class, size_t> class Model, class T, size_t NUM_VALUES>
+  requires MetricFor<Metric, Model>
+double meanDistance(const PixelSpan<Model, T, NUM_VALUES>& a, const PixelSpan<Model, T, NUM_VALUES>& b) {
+  if (a.empty()) {
+    return 0.;
+  }
+  double sum = 0.;
+  detail::forEachChunk<Metric>(a, b, [&sum](std::span<const float> chunk) {
+    float chunkSum = 0.f;
+    for (const float d : chunk) {
+      chunkSum += Metric::fromSquared(d);
+    }
+    sum += static_cast<double>(chunkSum);
+  });
+  return sum / static_cast<double>(a.size());
+}
+
+/**
+ * @brief Returns the number of pixels whose distance is greater than threshold.
+ */
+template <class Metric, template <class, size_t> class Model, class T, size_t NUM_VALUES>
+  requires MetricFor<Metric, Model>
+size_t countChanged(const PixelSpan<Model, T, NUM_VALUES>& a,
+                    const PixelSpan<Model, T, NUM_VALUES>& b,
+                    float threshold) {
+  // compared in squared form, no sqrt per pixel
+  const float squaredThreshold = Metric::toSquared(std::max(threshold, 0.f));
+  size_t changed               = 0;
+  detail::forEachChunk<Metric>(a, b, [&changed, squaredThreshold](std::span<const float> chunk) {
+    size_t chunkChanged = 0;
+    for (const float d : chunk) {
+      chunkChanged += static_cast<size_t>(d > squaredThreshold);
+    }
+    changed += chunkChanged;
+  });
+  return changed;
+}
+
+}  // namespace color::distance
@@ -0,0 +1,191 @@
+/**
+ * @file in_range.hpp
+ * @brief contains HSV range thresholding of RGB or HSV images into byte or packed bit masks.
+ *
+ * @detail For RGB images the RGB -> HSV conversion is fused into the comparison, no HSV image is created.
+ *         Pixels are widened into planar float chunks first so the HSV math runs at unit stride.
+ *
+ * @date 19.10.2026
+ * @author Jakob Wandel
+ * @version 1.0
+ **/
+
+#pragma once
+
+#include <color/color.hpp>
+#include <color/pixel_span.hpp>
+
+#include <algorithm>
+#include <array>
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <span>
+#include <type_traits>
+
+namespace color {
+
+template <template <class, size_t> class Model>
+concept RGBOrHSV = std::is_same_v<Model<float, 3>, RGB<float, 3>> ||
+                   std::is_same_v<Model<float, 3>, HSV<float, 3>>;
+
+namespace detail {
+constexpr std::uint8_t MASK_SET = 255;
+
+struct HSVBounds {
+  float hLow;
+  float hHigh;
+  float sLow;
+  float sHigh;
+  float vLow;
+  float vHigh;
+};
+
+template <class T, size_t NUM_VALUES>
+constexpr HSVBounds makeHSVBounds(const HSV<T, NUM_VALUES>& lower, const HSV<T, NUM_VALUES>& upper) {
+  // same normalization as the pixels so equal pigments compare equal
+  return {normalizedPigment<float>(lower.h()),
+          normalizedPigment<float>(upper.h()),
+          normalizedPigment<float>(lower.s()),
+          normalizedPigment<float>(upper.s()),
+          normalizedPigment<float>(lower.v()),
+          normalizedPigment<float>(upper.v())};
+}
+
+// Same result as convertToHSV but without branches: r[0-1], g[0-1], b[0-1] -> h[0-1], s[0-1], v[0-1]
+inline std::array<float, 3> fastRGBToHSV(float r, float g, float b) {
+  const float cMax     = std::max(std::max(r, g), b);
+  const float cMin     = std::min(std::min(r, g), b);
+  const float delta    = cMax - cMin;
+  // TINY replaces the delta == 0 case (r == g == b, all hue terms are 0)
+  constexpr float TINY = std::numeric_limits<float>::min();
+  const float invDelta = 1.f / (delta + TINY);
+
+  // sector blend: red wins over green wins over blue
+  const float isRed    = static_cast<float>(cMax == r);
+  const float isGreen  = (1.f - isRed) * static_cast<float>(cMax == g);
+  const float isBlue   = 1.f - isRed - isGreen;
+  const float hueRed   = (g - b) * invDelta;
+  const float hueGreen = (b - r) * invDelta + 2.f;
+  const float hueBlue  = (r - g) * invDelta + 4.f;
+  const float hue6     = isRed * hueRed + isGreen * hueGreen + isBlue * hueBlue;
+
+  constexpr float ONE_SIXTH = 1.f / 6.f;
+  const float h             = hue6 * ONE_SIXTH;
+  return {{h + (h < 0.f ? 1.f : 0.f), delta / (cMax + TINY), cMax}};
+}
+
+template <bool HUE_WRAPS>
+inline bool isInRange(const HSVBounds& bounds, float h, float s, float v) {
+  bool hueInRange;
+  if constexpr (HUE_WRAPS) {
+    hueInRange = (h >= bounds.hLow) | (h <= bounds.hHigh);
+  } else {
+    hueInRange = (h >= bounds.hLow) & (h <= bounds.hHigh);
+  }
+  return hueInRange & (s >= bounds.sLow) & (s <= bounds.sHigh) & (v >= bounds.vLow) & (v <= bounds.vHigh);
+}
+
+// strided (3 or 4 pigments per pixel) loads do not vectorize on SSE2, so widen into planar buffers first
+template <bool HUE_WRAPS, template <class, size_t> class Model, class T, size_t NUM_VALUES>
+void inRangeKernel(std::span<const T> pigments, const HSVBounds& bounds, std::span<std::uint8_t> mask) {
+  std::array<float, PIXEL_CHUNK_SIZE> p0;
+  std::array<float, PIXEL_CHUNK_SIZE> p1;
+  std::array<float, PIXEL_CHUNK_SIZE> p2;
+  for (size_t first = 0; first < mask.size(); first += PIXEL_CHUNK_SIZE) {
+    const size_t count = std::min(PIXEL_CHUNK_SIZE, mask.size() - first);
+    const T* chunk     = pigments.data() + first * NUM_VALUES;
+    for (size_t i = 0; i < count; ++i) {
+      p0[i] = normalizedPigment<float>(chunk[i * NUM_VALUES]);
+      p1[i] = normalizedPigment<float>(chunk[i * NUM_VALUES + 1]);
+      p2[i] = normalizedPigment<float>(chunk[i * NUM_VALUES + 2]);
+    }
+
+    std::uint8_t* chunkMask = mask.data() + first;
+    for (size_t i = 0; i < count; ++i) {
+      bool inRange;
+      if constexpr (std::is_same_v<Model<float, 3>, RGB<float, 3>>) {
+        const std::array<float, 3> hsv = fastRGBToHSV(p0[i], p1[i], p2[i]);
+        inRange = isInRange<HUE_WRAPS>(bounds, hsv[0], hsv[1], hsv[2]);
+      } else {
+        inRange = isInRange<HUE_WRAPS>(bounds, p0[i], p1[i], p2[i]);
+      }
+      chunkMask[i] = inRange ? MASK_SET : 0;
+    }
+  }
+}
+
+template <template <class, size_t> class Model, class T, size_t NUM_VALUES>
+void inRangeBytes(std::span<const T> pigments, const HSVBounds& bounds, std::span<std::uint8_t> mask) {
+  // lower hue > upper hue selects the range around 0, e.g. [0.9 - 0.1] for red
+  if (bounds.hLow > bounds.hHigh) {
+    inRangeKernel<true, Model, T, NUM_VALUES>(pigments, bounds, mask);
+  } else {
+    inRangeKernel<false, Model, T, NUM_VALUES>(pigments, bounds, mask);
+  }
+}
+}  // namespace detail
+
+/**
+ * @brief Writes 255 into mask for every pixel whose HSV is within [lower, upper], 0 otherwise.
+ *
+ * The bounds are inclusive. If lower.h() > upper.h() the hue range wraps around 0 (e.g. red from 0.9 to 0.1).
+ * Like the color classes an integral T means [0 - 255] (also for the hue) and a floating point T [0 - 1].
+ *
+ * @param image RGB or HSV image.
+ * @param mask One byte per pixel, size >= image.size().
+ */
+template <template <class, size_t> class Model, class T, size_t NUM_VALUES, class T_, size_t NUM_VALUES_>
+  requires RGBOrHSV<Model>
+void inRange(const PixelSpan<Model, T, NUM_VALUES>& image,
+             const HSV<T_, NUM_VALUES_>& lower,
+             const HSV<T_, NUM_VALUES_>& upper,
+             std::span<std::uint8_t> mask) {
+  assert(mask.size() >= image.size() && "Mask must hold one byte per pixel");
+  detail::inRangeBytes<Model, T, NUM_VALUES>(
+    image.pigments, detail::makeHSVBounds(lower, upper), mask.first(image.size()));
+}
+
+/**
+ * @brief Same as inRange but packs the mask into 1 bit per pixel.
+ *
+ * Pixel i is bit (i % 8) of byte i / 8, least significant bit first. Unused bits of the last byte are 0.
+ *
+ * @param image RGB or HSV image.
+ * @param bits Packed mask, size >= (image.size() + 7) / 8.
+ */
+template <template <class, size_t> class Model, class T, size_t NUM_VALUES, class T_, size_t NUM_VALUES_>
+  requires RGBOrHSV<Model>
+void inRangePacked(const PixelSpan<Model, T, NUM_VALUES>& image,
+                   const HSV<T_, NUM_VALUES_>& lower,
+                   const HSV<T_, NUM_VALUES_>& upper,
+                   std::span<std::uint8_t> bits) {
+  constexpr size_t BITS_PER_BYTE = 8;
+  static_assert(detail::PIXEL_CHUNK_SIZE % BITS_PER_BYTE == 0);
+  assert(bits.size() >= (image.size() + BITS_PER_BYTE - 1) / BITS_PER_BYTE &&
+         "Mask must hold one bit per pixel");
+
+  const detail::HSVBounds bounds = detail::makeHSVBounds(lower, upper);
+  std::array<std::uint8_t, detail::PIXEL_CHUNK_SIZE> buffer;
+
+  for (size_t first = 0; first < image.size(); first += detail::PIXEL_CHUNK_SIZE) {
+    const size_t count = std::min(detail::PIXEL_CHUNK_SIZE, image.size() - first);
+    const std::span<std::uint8_t> bytes(buffer.data(), count);
+    detail::inRangeBytes<Model, T, NUM_VALUES>(image.pigments.subspan(first * NUM_VALUES), bounds, bytes);
+
+    const size_t firstByte = first / BITS_PER_BYTE;
+    const size_t numBytes  = (count + BITS_PER_BYTE - 1) / BITS_PER_BYTE;
+    // pad the last byte with 0 so every byte packs 8 bits
+    std::fill(buffer.begin() + count, buffer.begin() + numBytes * BITS_PER_BYTE, 0);
+    for (size_t byte = 0; byte < numBytes; ++byte) {
+      unsigned packed = 0;
+      for (size_t bit = 0; bit < BITS_PER_BYTE; ++bit) {
+        packed |= static_cast<unsigned>(buffer[byte * BITS_PER_BYTE + bit] & 1U) << bit;
+      }
+      bits[firstByte + byte] = static_cast<std::uint8_t>(packed);
+    }
+  }
+}
+
+}  // namespace color
@@ -0,0 +1,31 @@
+/**
+ * @file io.hpp
+ * @brief contains the stream operator for the color classes.
+ *
+ * @detail Kept out of color.hpp so that users which do not print colors do not pay for the stream headers.
+ *         Only <ostream> is included, <iostream> (and its static initialization) is left to the user.
+ *
+ * @date 19.10.2026
+ * @author Jakob Wandel
+ * @version 1.0
+ **/
+
+#pragma once
+
+#include <color/color.hpp>
+
+#include <ostream>
+
+namespace color {
+
+template <class T, size_t NUM_VALUES>
+std::ostream& operator<<(std::ostream& os, const Color<T, NUM_VALUES>& c) {
+  os << c.getColorTypeName() << std::endl;
+  for (size_t i = 0; i < NUM_VALUES; ++i) {
+    os << "[" << c.pigmentName(i) << ": " << c.pigment[i] << "]";
+  }
+  os << std::endl;
+  return os;
+}
+
+}  // namespace color
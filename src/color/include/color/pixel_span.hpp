@@ -0,0 +1,83 @@
+/**
+ * @file pixel_span.hpp
+ * @brief contains a non owning, read only view on interleaved pigments (e.g. an image buffer) of one color model.
+ *
+ * @detail The bulk functions (distance, in_range, transfer) work on PixelSpan instead of spans of RGB/HSV
+ *         objects since those carry a vtable pointer and are not laid out as plain pigments.
+ *
+ *         Vectorization: the bulk kernels are plain loops the compiler vectorizes at -O3 without intrinsics
+ *         or extra flags, also on the SSE2 baseline (the 8 bit table lookups are gathers and stay scalar).
+ *         sqrt, conditional division and ?: on floats are kept out of these loops: the compiler turns them
+ *         into branches it can not if-convert (floating point math could trap). Selects are written as bit
+ *         masks or arithmetic blends instead. Kernels that reduce or repack work on chunks of
+ *         PIXEL_CHUNK_SIZE pixels in stack buffers.
+ *
+ * @date 19.10.2026
+ * @author Jakob Wandel
+ * @version 1.0
+ **/
+
+#pragma once
+
+#include <color/color.hpp>
+
+#include <cassert>
+#include <cstddef>
+#include <span>
+#include <type_traits>
+
+namespace color {
+
+namespace detail {
+// number of pixels the bulk kernels evaluate into a stack buffer at a time
+constexpr size_t PIXEL_CHUNK_SIZE = 256;
+}  // namespace detail
+
+/**
+ * @brief View on interleaved pigments, NUM_VALUES pigments per pixel.
+ *
+ * The Model (RGB, HSV, ...) only tags the meaning of the pigments. Like the color classes an
+ * integral T means [0 - 255] and a floating point T means [0 - 1].
+ *
+ * color::PixelSpan<color::RGB, std::uint8_t> image(buffer);  // rgbrgbrgb...
+ */
+template <template <class, size_t> class Model, class T, size_t NUM_VALUES = 3>
+class PixelSpan {
+ public:
+  static_assert(NUM_VALUES == 3 || NUM_VALUES == 4,
+                "The number of values (third template parameter) can only "
+                "be 3 (without alpha) or 4 (with alpha)");
+  static_assert(std::is_arithmetic_v<T>, "PixelSpan only supports arithmetic pigments");
+
+  constexpr static size_t num_values = NUM_VALUES;
+
+  constexpr PixelSpan(std::span<const T> pigments_)
+      : pigments(pigments_) {
+    assert(pigments.size() % NUM_VALUES == 0 &&
+           "The number of pigments must be a multiple of NUM_VALUES");
+  }
+
+  constexpr size_t size() const { return pigments.size() / NUM_VALUES; }
+  constexpr bool empty() const { return pigments.empty(); }
+
+  constexpr T operator()(size_t pixel, size_t pigment) const {
+    return pigments[pixel * NUM_VALUES + pigment];
+  }
+
+  std::span<const T> pigments;
+};
+
+/**
+ * @brief Maps a pigment onto [0 - 1] given the convention integral = [0 - 255], floating point = [0 - 1].
+ */
+template <class F, class T>
+constexpr F normalizedPigment(T pigment) {
+  if constexpr (std::is_floating_point_v<T>) {
+    return static_cast<F>(pigment);
+  } else {
+    constexpr F INV_MAX = static_cast<F>(1.) / static_cast<F>(255.);
+    return static_cast<F>(pigment) * INV_MAX;
+  }
+}
+
+}  // namespace color
@@ -0,0 +1,227 @@
+/**
+ * @file transfer.hpp
+ * @brief contains bulk sRGB <-> linear light conversions of images using lookup tables (8 bit) or polynomials (float).
+ *
+ * @detail 8 bit data uses a 256 entry decode table and a 4096 entry encode table (built on first use).
+ *         Float data uses polynomial approximations of log2/exp2 instead of std::pow.
+ *         Max absolute error against srgbToLinear()/linearToSRGB() on [0 - 1]: decode < 5e-6, encode < 2e-6.
+ *         8 bit encode is within 1 of the exact rounded value and clamps to [0 - 1] (NaN -> 0). The float paths
+ *         expect [0 - 1] and do not clamp (values below 0 follow the linear segment), NaN and +Inf give a
+ *         finite, non negative result. Alpha is copied.
+ *
+ * @date 19.10.2026
+ * @author Jakob Wandel
+ * @version 1.0
+ **/
+
+#pragma once
+
+#include <color/color.hpp>
+#include <color/pixel_span.hpp>
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cassert>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+
+namespace color {
+
+namespace detail {
+constexpr size_t DECODE_LUT_SIZE = 256;
+constexpr size_t ENCODE_LUT_SIZE = 4096;
+
+// 8 bit sRGB -> linear light [0-1]
+inline const std::array<float, DECODE_LUT_SIZE>& srgbDecodeLUT() {
+  static const std::array<float, DECODE_LUT_SIZE> lut = [] {
+    std::array<float, DECODE_LUT_SIZE> table{};
+    for (size_t i = 0; i < DECODE_LUT_SIZE; ++i) {
+      table[i] = static_cast<float>(srgbToLinear(static_cast<double>(i) / 255.));
+    }
+    return table;
+  }();
+  return lut;
+}
+
+// linear light, index round(c * 4095) -> 8 bit sRGB
+inline const std::array<std::uint8_t, ENCODE_LUT_SIZE>& srgbEncodeLUT() {
+  static const std::array<std::uint8_t, ENCODE_LUT_SIZE> lut = [] {
+    std::array<std::uint8_t, ENCODE_LUT_SIZE> table{};
+    for (size_t i = 0; i < ENCODE_LUT_SIZE; ++i) {
+      const double linear = static_cast<double>(i) / static_cast<double>(ENCODE_LUT_SIZE - 1);
+      table[i]            = static_cast<std::uint8_t>(std::round(linearToSRGB(linear) * 255.));
+    }
+    return table;
+  }();
+  return lut;
+}
+
+// log2 for normal, positive x. Max absolute error ~2.5e-6.
+inline float fastLog2(float x) {
+  constexpr std::uint32_t MANTISSA_MASK = 0x007FFFFFU;
+  constexpr std::uint32_t EXPONENT_ONE  = 0x3F800000U;
+  constexpr int MANTISSA_BITS           = 23;
+  constexpr int EXPONENT_BIAS           = 127;
+
+  const auto bits    = std::bit_cast<std::uint32_t>(x);
+  const int exponent = static_cast<int>(bits >> MANTISSA_BITS) - EXPONENT_BIAS;
+  // m in [0, 1): x = 2^exponent * (1 + m)
+  const float m = std::bit_cast<float>((bits & MANTISSA_MASK) | EXPONENT_ONE) - 1.f;
+
+  // minimax fit of log2(1 + m) on [0, 1]
+  constexpr std::array<float, 6> C = {{1.4425531344676414f,
+                                       -0.7182817724440431f,
+                                       0.45827013652734355f,
+                                       -0.27953679635329215f,
+                                       0.12345026321695748f,
+                                       -0.026457033919937575f}};
+  const float p = m * (C[0] + m * (C[1] + m * (C[2] + m * (C[3] + m * (C[4] + m * C[5])))));
+  return static_cast<float>(exponent) + p;
+}
+
+// 2^y for y in [-126, 127), the callers bound the input. Max relative error ~1.8e-7.
+inline float fastExp2(float y) {
+  constexpr int MANTISSA_BITS = 23;
+  constexpr int EXPONENT_BIAS = 127;
+
+  // y + bias > 0, so the conversion to int floors. f is taken from y, y + bias has lost precision.
+  const int biasedFloor = static_cast<int>(y + static_cast<float>(EXPONENT_BIAS));
+  const float f         = y - static_cast<float>(biasedFloor - EXPONENT_BIAS);
+  const float scale = std::bit_cast<float>(static_cast<std::uint32_t>(biasedFloor) << MANTISSA_BITS);
+
+  // minimax fit of 2^f on [0, 1]
+  constexpr std::array<float, 5> C = {{0.6931524715255716f,
+                                       0.2401528073059356f,
+                                       0.05583592732461225f,
+                                       0.008973378416160242f,
+                                       0.00188529742855067f}};
+  const float p = 1.f + f * (C[0] + f * (C[1] + f * (C[2] + f * (C[3] + f * C[4]))));
+  return scale * p;
+}
+
+// condition ? a : b as bit mask select, see pixel_span.hpp
+inline float select(bool condition, float a, float b) {
+  const std::uint32_t mask = 0U - static_cast<std::uint32_t>(condition);
+  return std::bit_cast<float>((std::bit_cast<std::uint32_t>(a) & mask) |
+                              (std::bit_cast<std::uint32_t>(b) & ~mask));
+}
+
+// same curve as srgbToLinear() without branches
+inline float fastSRGBToLinear(float c) {
+  constexpr float THRESHOLD = 0.04045f;
+  constexpr float SLOPE     = 12.92f;
+  constexpr float OFFSET    = 0.055f;
+  constexpr float GAMMA     = 2.4f;
+  // 2.4 * log2(MAX_BASE) < 127 keeps the exponent of fastExp2 in range
+  constexpr float MAX_BASE  = 1e15f;
+
+  // The curve is evaluated for all values and selected afterwards, so keep the log2 input normal and
+  // bounded. NaN and Inf fail the comparisons and land on the bounds.
+  const float lowered = (select(c > THRESHOLD, c, THRESHOLD) + OFFSET) * (1.f / (1.f + OFFSET));
+  const float base    = select(lowered < MAX_BASE, lowered, MAX_BASE);
+  const float curve   = fastExp2(GAMMA * fastLog2(base));
+  return select(c <= THRESHOLD, c * (1.f / SLOPE), curve);
+}
+
+// same curve as linearToSRGB() without branches
+inline float fastLinearToSRGB(float c) {
+  constexpr float THRESHOLD = 0.0031308f;
+  constexpr float SLOPE     = 12.92f;
+  constexpr float OFFSET    = 0.055f;
+  constexpr float GAMMA     = 2.4f;
+
+  // NaN fails the comparison and lands on THRESHOLD, log2(Inf) / 2.4 is still in range of fastExp2
+  const float base  = select(c > THRESHOLD, c, THRESHOLD);
+  const float curve = (1.f + OFFSET) * fastExp2(fastLog2(base) * (1.f / GAMMA)) - OFFSET;
+  return select(c <= THRESHOLD, c * SLOPE, curve);
+}
+
+// constant first: std::max/min return their first argument for NaN comparisons, so NaN maps to 0
+inline float clampUnit(float c) {
+  return std::min(1.f, std::max(0.f, c));
+}
+
+inline std::uint8_t lutLinearToSRGB(const std::array<std::uint8_t, ENCODE_LUT_SIZE>& lut, float c) {
+  constexpr float MAX_INDEX = static_cast<float>(ENCODE_LUT_SIZE - 1);
+  return lut[static_cast<size_t>(clampUnit(c) * MAX_INDEX + 0.5f)];
+}
+
+inline std::uint8_t toByte(float c) {
+  return static_cast<std::uint8_t>(clampUnit(c) * 255.f + 0.5f);
+}
+}  // namespace detail
+
+/**
+ * @brief Decodes an 8 bit sRGB image into linear light floats [0 - 1] (interleaved like the input) using a lookup table.
+ */
+template <size_t NUM_VALUES>
+void toLinear(const PixelSpan<RGB, std::uint8_t, NUM_VALUES>& image, std::span<float> linear) {
+  assert(linear.size() >= image.pigments.size() && "Output must hold as many pigments as the input");
+  const std::array<float, detail::DECODE_LUT_SIZE>& lut = detail::srgbDecodeLUT();
+  for (size_t i = 0; i < image.size(); ++i) {
+    const size_t o = i * NUM_VALUES;
+    linear[o]      = lut[image.pigments[o]];
+    linear[o + 1]  = lut[image.pigments[o + 1]];
+    linear[o + 2]  = lut[image.pigments[o + 2]];
+    if constexpr (NUM_VALUES == 4) {
+      linear[o + 3] = normalizedPigment<float>(image.pigments[o + 3]);
+    }
+  }
+}
+
+/**
+ * @brief Decodes a float sRGB image into linear light floats [0 - 1] using a polynomial approximation of pow.
+ */
+template <size_t NUM_VALUES>
+void toLinear(const PixelSpan<RGB, float, NUM_VALUES>& image, std::span<float> linear) {
+  assert(linear.size() >= image.pigments.size() && "Output must hold as many pigments as the input");
+  for (size_t i = 0; i < image.size(); ++i) {
+    const size_t o = i * NUM_VALUES;
+    linear[o]      = detail::fastSRGBToLinear(image.pigments[o]);
+    linear[o + 1]  = detail::fastSRGBToLinear(image.pigments[o + 1]);
+    linear[o + 2]  = detail::fastSRGBToLinear(image.pigments[o + 2]);
+    if constexpr (NUM_VALUES == 4) {
+      linear[o + 3] = image.pigments[o + 3];
+    }
+  }
+}
+
+/**
+ * @brief Encodes a linear light float image into 8 bit sRGB using a lookup table.
+ */
+template <size_t NUM_VALUES>
+void toSRGB(const PixelSpan<LinearRGB, float, NUM_VALUES>& image, std::span<std::uint8_t> srgb) {
+  assert(srgb.size() >= image.pigments.size() && "Output must hold as many pigments as the input");
+  const std::array<std::uint8_t, detail::ENCODE_LUT_SIZE>& lut = detail::srgbEncodeLUT();
+  for (size_t i = 0; i < image.size(); ++i) {
+    const size_t o = i * NUM_VALUES;
+    srgb[o]        = detail::lutLinearToSRGB(lut, image.pigments[o]);
+    srgb[o + 1]    = detail::lutLinearToSRGB(lut, image.pigments[o + 1]);
+    srgb[o + 2]    = detail::lutLinearToSRGB(lut, image.pigments[o + 2]);
+    if constexpr (NUM_VALUES == 4) {
+      srgb[o + 3] = detail::toByte(image.pigments[o + 3]);
+    }
+  }
+}
+
+/**
+ * @brief Encodes a linear light float image into float sRGB [0 - 1] using a polynomial approximation of pow.
+ */
+template <size_t NUM_VALUES>
+void toSRGB(const PixelSpan<LinearRGB, float, NUM_VALUES>& image, std::span<float> srgb) {
+  assert(srgb.size() >= image.pigments.size() && "Output must hold as many pigments as the input");
+  for (size_t i = 0; i < image.size(); ++i) {
+    const size_t o = i * NUM_VALUES;
+    srgb[o]        = detail::fastLinearToSRGB(image.pigments[o]);
+    srgb[o + 1]    = detail::fastLinearToSRGB(image.pigments[o + 1]);
+    srgb[o + 2]    = detail::fastLinearToSRGB(image.pigments[o + 2]);
+    if constexpr (NUM_VALUES == 4) {
+      srgb[o + 3] = image.pigments[o + 3];
+    }
+  }
+}
+
+}  // namespace color
@@ -0,0 +1,56 @@
+/**
+ * @file color.cppm
+ * @brief C++20 named module "color" exporting the public api of the color headers.
+ *
+ * @detail Build with -DCOLOR_LIB_BUILD_MODULE=ON and use `import color;` instead of including the headers.
+ *
+ * @date 19.10.2026
+ * @author Jakob Wandel
+ * @version 1.0
+ **/
+
+module;
+
+#include <color/color.hpp>
+#include <color/distance.hpp>
+#include <color/in_range.hpp>
+#include <color/io.hpp>
+#include <color/pixel_span.hpp>
+#include <color/transfer.hpp>
+
+export module color;
+
+export namespace color {
+using color::BaseColor;
+using color::Color;
+using color::NeedsConversation;
+using color::RGB;
+using color::LinearRGB;
+using color::HSV;
+using color::convertToRGB;
+using color::convertToHSV;
+using color::srgbToLinear;
+using color::linearToSRGB;
+using color::toLinear;
+using color::toSRGB;
+using color::operator<<;
+using color::PixelSpan;
+using color::normalizedPigment;
+using color::RGBOrHSV;
+using color::inRange;
+using color::inRangePacked;
+}  // namespace color
+
+export namespace color::distance {
+using color::distance::EuclideanSquared;
+using color::distance::Redmean;
+using color::distance::HueAware;
+using color::distance::MetricFor;
+using color::distance::euclideanSquared;
+using color::distance::redmean;
+using color::distance::hueAware;
+using color::distance::perPixelDistances;
+using color::distance::maxDistance;
+using color::distance::meanDistance;
+using color::distance::countChanged;
+}  // namespace color::distance
@@ -8,6 +8,7 @@
 
 #include <array>
 #include <color/color.hpp>
+#include <color/io.hpp>
 
 #include <cstdio>
 #include <iostream>
@@ -11,6 +11,7 @@
  **/
 
 #include <color/color.hpp>
+#include <color/io.hpp>
 
 #include <cstdint>
 #include <cstdio>
@@ -10,6 +10,7 @@
 #include <catch2/catch_approx.hpp>
 
 #include <color/color.hpp>
+#include <color/io.hpp>
 
 #include <array>
 #include <cstdlib>
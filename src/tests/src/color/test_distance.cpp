@@ -0,0 +1,125 @@
+/**
+ * @file test_distance.cpp
+ * @brief Unit Tests using Catch2 for the color distance metrics and batched image kernels
+ * @date 19.10.2026
+ * @author Jakob Wandel
+ * @version 1.0
+ **/
+
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/catch_approx.hpp>
+
+#include <color/color.hpp>
+#include <color/distance.hpp>
+#include <color/pixel_span.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <vector>
+
+
+TEST_CASE("distance_single_color_metrics") {
+  constexpr double TOLERANCE = 0.00001;
+
+  const color::RGB<int> black(0, 0, 0);
+  const color::RGB<int> white(255, 255, 255);
+
+  REQUIRE(color::distance::euclideanSquared(black, black) == Catch::Approx(0.).margin(TOLERANCE));
+  REQUIRE(color::distance::euclideanSquared(black, white) == Catch::Approx(3.).epsilon(TOLERANCE));
+  REQUIRE(color::distance::redmean(black, white) == Catch::Approx(3.).epsilon(TOLERANCE));
+
+  // redmean weights red more for reddish colors and blue more for dark ones
+  const color::RGB<double> red(1., 0., 0.);
+  const color::RGB<double> redBlue(1., 0., 1.);
+  const color::RGB<double> blue(0., 0., 1.);
+  REQUIRE(color::distance::redmean(red, redBlue) == Catch::Approx(std::sqrt(2.)).epsilon(TOLERANCE));
+  REQUIRE(color::distance::redmean(blue, color::RGB<double>(0., 0., 0.)) ==
+          Catch::Approx(std::sqrt(3.)).epsilon(TOLERANCE));
+
+  // NOLINTBEGIN(readability-magic-numbers) // yes these are random numbers without meaning
+  // the hue difference is taken around the circle: 0.95 and 0.05 are 0.1 apart, scaled by 2
+  const color::HSV<double> almostRed(0.95, 1., 1.);
+  const color::HSV<double> orange(0.05, 1., 1.);
+  REQUIRE(color::distance::hueAware(almostRed, orange) == Catch::Approx(0.2).epsilon(TOLERANCE));
+  REQUIRE(color::distance::hueAware(color::HSV<double>(0., 1., 1.), color::HSV<double>(0.5, 1., 1.)) ==
+          Catch::Approx(1.).epsilon(TOLERANCE));
+  // NOLINTEND(readability-magic-numbers)
+}
+
+TEST_CASE("distance_batched_matches_single_color") {
+  constexpr double TOLERANCE  = 0.0001;
+  constexpr size_t NUM_PIXELS = 1000;  // more than one chunk
+
+  std::vector<std::uint8_t> pigmentsA(NUM_PIXELS * 4);
+  std::vector<std::uint8_t> pigmentsB(NUM_PIXELS * 4);
+  for (size_t i = 0; i < pigmentsA.size(); ++i) {
+    // NOLINTBEGIN(readability-magic-numbers) // some deterministic noise
+    pigmentsA[i] = static_cast<std::uint8_t>((i * 37U) % 256U);
+    pigmentsB[i] = static_cast<std::uint8_t>((i * 11U + 5U) % 256U);
+    // NOLINTEND(readability-magic-numbers)
+  }
+
+  const color::PixelSpan<color::RGB, std::uint8_t, 4> imageA(pigmentsA);
+  const color::PixelSpan<color::RGB, std::uint8_t, 4> imageB(pigmentsB);
+  REQUIRE(imageA.size() == NUM_PIXELS);
+
+  std::vector<float> distances(NUM_PIXELS);
+  color::distance::perPixelDistances<color::distance::Redmean>(imageA, imageB, distances);
+
+  // countChanged compares squared distances, it must agree with the sqrt of the reference
+  constexpr double THRESHOLD = 1.;
+  size_t numChanged          = 0;
+  double maximum             = 0.;
+  double sum                 = 0.;
+  for (size_t i = 0; i < NUM_PIXELS; ++i) {
+    const color::RGB<int, 4> a(imageA(i, 0), imageA(i, 1), imageA(i, 2), imageA(i, 3));
+    const color::RGB<int, 4> b(imageB(i, 0), imageB(i, 1), imageB(i, 2), imageB(i, 3));
+    const double expected = color::distance::redmean(a, b);
+    REQUIRE(distances[i] == Catch::Approx(expected).epsilon(TOLERANCE));
+    maximum = std::max(maximum, expected);
+    sum += expected;
+    numChanged += static_cast<size_t>(expected > THRESHOLD);
+  }
+  REQUIRE(numChanged > 0);
+  REQUIRE(numChanged < NUM_PIXELS);
+  REQUIRE(color::distance::countChanged<color::distance::Redmean>(
+            imageA, imageB, static_cast<float>(THRESHOLD)) == numChanged);
+
+  REQUIRE(color::distance::maxDistance<color::distance::Redmean>(imageA, imageB) ==
+          Catch::Approx(maximum).epsilon(TOLERANCE));
+  REQUIRE(color::distance::meanDistance<color::distance::Redmean>(imageA, imageB) ==
+          Catch::Approx(sum / NUM_PIXELS).epsilon(TOLERANCE));
+}
+
+TEST_CASE("distance_count_changed_pixels") {
+  // NOLINTBEGIN(readability-magic-numbers) // yes these are random numbers without meaning
+  std::vector<float> reference(300 * 3, 0.5f);
+  std::vector<float> screenshot(reference);
+  screenshot[0]       = 0.6f;  // pixel 0, small change
+  screenshot[10 * 3]  = 1.f;    // pixel 10, large change
+  screenshot[299 * 3] = 0.f;    // pixel 299, large change (second chunk)
+
+  const color::PixelSpan<color::RGB, float> imageA(reference);
+  const color::PixelSpan<color::RGB, float> imageB(screenshot);
+
+  using color::distance::EuclideanSquared;
+  REQUIRE(color::distance::countChanged<EuclideanSquared>(imageA, imageA, 0.f) == 0);
+  REQUIRE(color::distance::countChanged<EuclideanSquared>(imageA, imageB, 0.f) == 3);
+  REQUIRE(color::distance::countChanged<EuclideanSquared>(imageA, imageB, 0.1f) == 2);
+  REQUIRE(color::distance::maxDistance<EuclideanSquared>(imageA, imageB) == Catch::Approx(0.25f));
+
+  // HSV images use the circular hue difference
+  std::vector<float> hsvA{0.95f, 1.f, 1.f};
+  std::vector<float> hsvB{0.05f, 1.f, 1.f};
+  REQUIRE(color::distance::maxDistance<color::distance::HueAware>(
+            color::PixelSpan<color::HSV, float>(hsvA), color::PixelSpan<color::HSV, float>(hsvB)) ==
+          Catch::Approx(0.2f));
+
+  // empty images
+  const std::vector<float> empty;
+  const color::PixelSpan<color::RGB, float> emptyImage(empty);
+  REQUIRE(color::distance::meanDistance<EuclideanSquared>(emptyImage, emptyImage) == 0.);
+  REQUIRE(color::distance::countChanged<EuclideanSquared>(emptyImage, emptyImage, 0.f) == 0);
+  // NOLINTEND(readability-magic-numbers)
+}
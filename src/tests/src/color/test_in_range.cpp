@@ -0,0 +1,134 @@
+/**
+ * @file test_in_range.cpp
+ * @brief Unit Tests using Catch2 for the HSV range thresholding of RGB and HSV images
+ * @date 19.10.2026
+ * @author Jakob Wandel
+ * @version 1.0
+ **/
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <color/color.hpp>
+#include <color/in_range.hpp>
+#include <color/pixel_span.hpp>
+
+#include <cmath>
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+namespace {
+bool isInRangeReference(const color::HSV<double>& hsv,
+                        const color::HSV<double>& lower,
+                        const color::HSV<double>& upper) {
+  const bool hueInRange = lower.h() <= upper.h() ? (hsv.h() >= lower.h() && hsv.h() <= upper.h())
+                                                 : (hsv.h() >= lower.h() || hsv.h() <= upper.h());
+  return hueInRange && hsv.s() >= lower.s() && hsv.s() <= upper.s() && hsv.v() >= lower.v() &&
+         hsv.v() <= upper.v();
+}
+
+bool isCloseToBound(const color::HSV<double>& hsv,
+                    const color::HSV<double>& lower,
+                    const color::HSV<double>& upper) {
+  constexpr double TOLERANCE = 0.0001;
+  for (size_t i = 0; i < 3; ++i) {
+    if (std::abs(hsv[i] - lower[i]) < TOLERANCE || std::abs(hsv[i] - upper[i]) < TOLERANCE) {
+      return true;
+    }
+  }
+  return false;
+}
+}  // namespace
+
+
+TEST_CASE("in_range_rgb_matches_convertToHSV") {
+  // NOLINTBEGIN(readability-magic-numbers) // yes these are random numbers without meaning
+  std::vector<std::uint8_t> pigments;
+  for (int r = 0; r < 256; r += 15) {
+    for (int g = 0; g < 256; g += 15) {
+      for (int b = 0; b < 256; b += 15) {
+        pigments.push_back(static_cast<std::uint8_t>(r));
+        pigments.push_back(static_cast<std::uint8_t>(g));
+        pigments.push_back(static_cast<std::uint8_t>(b));
+      }
+    }
+  }
+  const color::PixelSpan<color::RGB, std::uint8_t> image(pigments);
+
+  // second pair wraps around red
+  const std::vector<std::pair<color::HSV<double>, color::HSV<double>>> bounds = {
+    {color::HSV<double>(0.1, 0.3, 0.2), color::HSV<double>(0.45, 0.9, 1.)},
+    {color::HSV<double>(0.9, 0.5, 0.5), color::HSV<double>(0.05, 1., 1.)}};
+  // NOLINTEND(readability-magic-numbers)
+
+  for (const auto& [lower, upper] : bounds) {
+    std::vector<std::uint8_t> mask(image.size());
+    color::inRange(image, lower, upper, mask);
+
+    size_t numInRange = 0;
+    for (size_t i = 0; i < image.size(); ++i) {
+      const color::RGB<int> rgbi(image(i, 0), image(i, 1), image(i, 2));
+      const color::HSV<double> hsv(color::convertToHSV(color::RGB<double>(rgbi)));
+      if (isCloseToBound(hsv, lower, upper)) {
+        continue;
+      }
+      const bool expected = isInRangeReference(hsv, lower, upper);
+      REQUIRE(mask[i] == (expected ? 255 : 0));
+      numInRange += static_cast<size_t>(expected);
+    }
+    REQUIRE(numInRange > 0);
+    REQUIRE(numInRange < image.size());
+  }
+}
+
+TEST_CASE("in_range_hsv_inclusive_bounds") {
+  // NOLINTBEGIN(readability-magic-numbers) // yes these are random numbers without meaning
+  const std::vector<int> pigments = {
+    10,  100, 100,  // lower bound exactly
+    20,  200, 200,  // upper bound exactly
+    9,   150, 150,  // hue too small
+    15,  99,  150,  // saturation too small
+    15,  150, 201,  // value too big
+    250, 150, 150,  // hue too big
+  };
+  const color::PixelSpan<color::HSV, int> image(pigments);
+  const color::HSV<int> lower(10, 100, 100);
+  const color::HSV<int> upper(20, 200, 200);
+
+  std::vector<std::uint8_t> mask(image.size());
+  color::inRange(image, lower, upper, mask);
+  REQUIRE(mask == std::vector<std::uint8_t>{255, 255, 0, 0, 0, 0});
+
+  // hue wraps around 0: [240 - 10]
+  color::inRange(image, color::HSV<int>(240, 0, 0), color::HSV<int>(10, 255, 255), mask);
+  REQUIRE(mask == std::vector<std::uint8_t>{255, 0, 255, 0, 0, 255});
+  // NOLINTEND(readability-magic-numbers)
+}
+
+TEST_CASE("in_range_packed_matches_bytes") {
+  // NOLINTBEGIN(readability-magic-numbers) // yes these are random numbers without meaning
+  for (const size_t numPixels : {1U, 8U, 13U, 256U, 300U}) {
+    std::vector<float> pigments(numPixels * 4);
+    for (size_t i = 0; i < pigments.size(); ++i) {
+      pigments[i] = static_cast<float>((i * 37U) % 100U) / 100.f;
+    }
+    const color::PixelSpan<color::RGB, float, 4> image(pigments);
+    const color::HSV<float> lower(0.2f, 0.1f, 0.1f);
+    const color::HSV<float> upper(0.8f, 1.f, 1.f);
+
+    std::vector<std::uint8_t> bytes(numPixels);
+    color::inRange(image, lower, upper, bytes);
+
+    // 0xAA checks that unused bits of the last byte are cleared
+    std::vector<std::uint8_t> bits((numPixels + 7) / 8, 0xAA);
+    color::inRangePacked(image, lower, upper, bits);
+
+    for (size_t i = 0; i < numPixels; ++i) {
+      REQUIRE(((bits[i / 8] >> (i % 8)) & 1U) == (bytes[i] == 255 ? 1U : 0U));
+    }
+    if (numPixels % 8 != 0) {
+      REQUIRE((bits.back() >> (numPixels % 8)) == 0);
+    }
+  }
+  // NOLINTEND(readability-magic-numbers)
+}
@@ -0,0 +1,143 @@
+/**
+ * @file test_transfer.cpp
+ * @brief Unit Tests using Catch2 for the sRGB <-> linear light conversions and color::LinearRGB
+ * @date 19.10.2026
+ * @author Jakob Wandel
+ * @version 1.0
+ **/
+
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/catch_approx.hpp>
+
+#include <color/color.hpp>
+#include <color/pixel_span.hpp>
+#include <color/transfer.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <cstdlib>
+#include <limits>
+#include <vector>
+
+
+TEST_CASE("transfer_linear_rgb_round_trip") {
+  constexpr double TOLERANCE = 0.000001;
+
+  // NOLINTBEGIN(readability-magic-numbers) // known points of the sRGB curve
+  REQUIRE(color::srgbToLinear(0.) == Catch::Approx(0.).margin(TOLERANCE));
+  REQUIRE(color::srgbToLinear(1.) == Catch::Approx(1.).epsilon(TOLERANCE));
+  REQUIRE(color::srgbToLinear(0.5) == Catch::Approx(0.2140411).epsilon(TOLERANCE));
+  REQUIRE(color::linearToSRGB(0.2140411) == Catch::Approx(0.5).epsilon(TOLERANCE));
+
+  const color::RGB<int, 4> rgbi(128, 64, 255, 50);
+  const color::LinearRGB<double, 4> linear(color::toLinear(color::RGB<double, 4>(rgbi)));
+  REQUIRE(linear.getColorTypeName() == "LinearRGBA");
+  REQUIRE(linear.a() == Catch::Approx(50. / 255.).epsilon(TOLERANCE));  // alpha is not gamma encoded
+  REQUIRE(linear.b() == Catch::Approx(1.).epsilon(TOLERANCE));
+
+  const color::RGB<int, 4> rgbi2(color::toSRGB(linear));
+  REQUIRE(rgbi2.r() == 128);
+  REQUIRE(rgbi2.g() == 64);
+  REQUIRE(rgbi2.b() == 255);
+  REQUIRE(rgbi2.a() == 50);
+  // NOLINTEND(readability-magic-numbers)
+}
+
+TEST_CASE("transfer_8bit_lookup_tables") {
+  constexpr int MAX_INTENSITY = 255;
+
+  std::vector<std::uint8_t> pigments;
+  for (int byteValue = 0; byteValue <= MAX_INTENSITY; ++byteValue) {
+    pigments.push_back(static_cast<std::uint8_t>(byteValue));
+    pigments.push_back(static_cast<std::uint8_t>(MAX_INTENSITY - byteValue));
+    pigments.push_back(static_cast<std::uint8_t>(byteValue));
+    pigments.push_back(static_cast<std::uint8_t>(byteValue));
+  }
+  const color::PixelSpan<color::RGB, std::uint8_t, 4> image(pigments);
+
+  std::vector<float> linear(pigments.size());
+  color::toLinear(image, linear);
+
+  std::vector<std::uint8_t> srgb(pigments.size());
+  color::toSRGB(color::PixelSpan<color::LinearRGB, float, 4>(linear), srgb);
+
+  for (size_t i = 0; i < pigments.size(); ++i) {
+    const bool isAlpha = i % 4 == 3;
+    const double expected =
+      isAlpha ? pigments[i] / 255. : color::srgbToLinear(pigments[i] / 255.);
+    REQUIRE(linear[i] == Catch::Approx(expected).margin(0.000001));
+    // 8 bit values survive the round trip through linear light
+    REQUIRE(srgb[i] == pigments[i]);
+  }
+
+  // the encode table is within 1 of the exact curve for arbitrary linear values and clamps
+  constexpr size_t NUM_SAMPLES = 10000;
+  std::vector<float> samples(NUM_SAMPLES * 3);
+  for (size_t i = 0; i < samples.size(); ++i) {
+    samples[i] = static_cast<float>(i) / static_cast<float>(samples.size() - 1);
+  }
+  samples.front() = -0.5f;
+  samples.back()  = 1.5f;
+  std::vector<std::uint8_t> encoded(samples.size());
+  color::toSRGB(color::PixelSpan<color::LinearRGB, float>(samples), encoded);
+  for (size_t i = 1; i + 1 < samples.size(); ++i) {
+    const long exact = std::lround(color::linearToSRGB(samples[i]) * 255.);
+    REQUIRE(std::abs(static_cast<long>(encoded[i]) - exact) <= 1);
+  }
+  REQUIRE(encoded.front() == 0);
+  REQUIRE(encoded.back() == 255);
+
+  // NaN must not index outside of the table, it encodes as 0 (also for alpha)
+  const std::vector<float> nan(4, std::numeric_limits<float>::quiet_NaN());
+  std::vector<std::uint8_t> nanEncoded(nan.size(), 1);
+  color::toSRGB(color::PixelSpan<color::LinearRGB, float, 4>(nan), nanEncoded);
+  REQUIRE(nanEncoded == std::vector<std::uint8_t>(nan.size(), 0));
+}
+
+TEST_CASE("transfer_float_polynomial_error_bound") {
+  constexpr double DECODE_MAX_ERROR = 0.000005;
+  constexpr double ENCODE_MAX_ERROR = 0.000002;
+  constexpr size_t NUM_SAMPLES      = 100000;
+
+  std::vector<float> samples(NUM_SAMPLES * 3);
+  for (size_t i = 0; i < samples.size(); ++i) {
+    samples[i] = static_cast<float>(i) / static_cast<float>(samples.size() - 1);
+  }
+
+  std::vector<float> linear(samples.size());
+  color::toLinear(color::PixelSpan<color::RGB, float>(samples), linear);
+  std::vector<float> srgb(samples.size());
+  color::toSRGB(color::PixelSpan<color::LinearRGB, float>(samples), srgb);
+
+  double maxDecodeError = 0.;
+  double maxEncodeError = 0.;
+  for (size_t i = 0; i < samples.size(); ++i) {
+    maxDecodeError = std::max(maxDecodeError, std::abs(linear[i] - color::srgbToLinear(samples[i])));
+    maxEncodeError = std::max(maxEncodeError, std::abs(srgb[i] - color::linearToSRGB(samples[i])));
+  }
+  REQUIRE(maxDecodeError < DECODE_MAX_ERROR);
+  REQUIRE(maxEncodeError < ENCODE_MAX_ERROR);
+
+  // NaN and Inf must give a defined, not negative result (the log2 input is bounded)
+  const std::vector<float> nonFinite = {std::numeric_limits<float>::quiet_NaN(),
+                                        std::numeric_limits<float>::infinity(),
+                                        std::numeric_limits<float>::quiet_NaN()};
+  std::vector<float> nonFiniteLinear(nonFinite.size());
+  std::vector<float> nonFiniteSRGB(nonFinite.size());
+  color::toLinear(color::PixelSpan<color::RGB, float>(nonFinite), nonFiniteLinear);
+  color::toSRGB(color::PixelSpan<color::LinearRGB, float>(nonFinite), nonFiniteSRGB);
+  for (size_t i = 0; i < nonFinite.size(); ++i) {
+    REQUIRE(std::isfinite(nonFiniteLinear[i]));
+    REQUIRE(nonFiniteLinear[i] >= 0.f);
+    REQUIRE(std::isfinite(nonFiniteSRGB[i]));
+    REQUIRE(nonFiniteSRGB[i] >= 0.f);
+  }
+
+  // alpha is copied
+  std::vector<float> rgba = {0.5f, 0.5f, 0.5f, 0.25f};
+  std::vector<float> linearRgba(rgba.size());
+  color::toLinear(color::PixelSpan<color::RGB, float, 4>(rgba), linearRgba);
+  REQUIRE(linearRgba[3] == 0.25f);
+  REQUIRE(linearRgba[0] == Catch::Approx(color::srgbToLinear(0.5)).margin(DECODE_MAX_ERROR));
+}
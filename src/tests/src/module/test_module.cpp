@@ -0,0 +1,65 @@
+/**
+ * @file test_module.cpp
+ * @brief Smoke Test using Catch2 for the C++20 module "color": one symbol of every exported header.
+ * @detail Only built with -DCOLOR_LIB_BUILD_MODULE=ON. Uses no color header, everything comes from `import color;`.
+ * @date 19.10.2026
+ * @author Jakob Wandel
+ * @version 1.0
+ **/
+
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/catch_approx.hpp>
+
+#include <cstdint>
+#include <sstream>
+#include <vector>
+
+import color;
+
+
+TEST_CASE("module_exports_color_classes") {
+  // color.hpp
+  const color::RGB<int> rgbi(255, 0, 0);
+  const color::HSV<double> hsv(color::convertToHSV(color::RGB<double>(rgbi)));
+  REQUIRE(hsv.h() == Catch::Approx(0.));
+  REQUIRE(color::convertToRGB(hsv).r() == Catch::Approx(1.));
+  const color::LinearRGB<double> linear(color::toLinear(color::RGB<double>(rgbi)));
+  REQUIRE(color::toSRGB(linear).r() == Catch::Approx(1.));
+  REQUIRE(color::srgbToLinear(color::linearToSRGB(0.5)) == Catch::Approx(0.5));
+
+  // io.hpp
+  std::ostringstream stream;
+  stream << rgbi;
+  REQUIRE(!stream.str().empty());
+}
+
+TEST_CASE("module_exports_image_kernels") {
+  // NOLINTBEGIN(readability-magic-numbers) // yes these are random numbers without meaning
+  const std::vector<std::uint8_t> pigmentsA = {255, 0, 0, 0, 255, 0};
+  const std::vector<std::uint8_t> pigmentsB = {255, 0, 0, 0, 0, 255};
+  // NOLINTEND(readability-magic-numbers)
+
+  // pixel_span.hpp
+  const color::PixelSpan<color::RGB, std::uint8_t> imageA(pigmentsA);
+  const color::PixelSpan<color::RGB, std::uint8_t> imageB(pigmentsB);
+  REQUIRE(imageA.size() == 2);
+  REQUIRE(color::normalizedPigment<float>(imageA(0, 0)) == 1.f);
+
+  // distance.hpp
+  using color::distance::EuclideanSquared;
+  REQUIRE(color::distance::countChanged<EuclideanSquared>(imageA, imageB, 0.f) == 1);
+  REQUIRE(color::distance::euclideanSquared(color::RGB<int>(0, 0, 0), color::RGB<int>(0, 0, 255)) ==
+          Catch::Approx(1.));
+
+  // in_range.hpp: red only
+  std::vector<std::uint8_t> mask(imageA.size());
+  color::inRange(imageA, color::HSV<float>(0.9f, 0.5f, 0.5f), color::HSV<float>(0.1f, 1.f, 1.f), mask);
+  REQUIRE(mask == std::vector<std::uint8_t>{255, 0});
+
+  // transfer.hpp
+  std::vector<float> linear(pigmentsA.size());
+  color::toLinear(imageA, linear);
+  std::vector<std::uint8_t> srgb(pigmentsA.size());
+  color::toSRGB(color::PixelSpan<color::LinearRGB, float>(linear), srgb);
+  REQUIRE(srgb == pigmentsA);
+}